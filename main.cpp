@@ -13,6 +13,10 @@
 #include <numeric>
 #include <functional>
 #include <type_traits>
+#include <thread>
+#include <queue>
+#include <atomic>
+#include <system_error>
 
 // Funkcja sprawdzająca, czy tablica jest posortowana (rosnąco)
 template <typename T>
@@ -44,6 +48,15 @@ public:
     template<typename T>
     static void quickSort(std::vector<T>& arr, int pivotType);
 
+    // Sortuje tablicę wybranym algorytmem (1-4); zwraca false dla nieznanego algorytmu
+    template<typename T>
+    static bool sort(std::vector<T>& arr, int algorithm, int option);
+
+    // Sprawdza, czy numer algorytmu jest obsługiwany przez sort()
+    static bool isValidAlgorithm(int algorithm) {
+        return algorithm >= 1 && algorithm <= 4;
+    }
+
 private:
     // Funkcja pomocnicza do budowy kopca
     template<typename T>
@@ -85,6 +98,38 @@ public:
     // Wczytuje tablicę z pliku
     template <typename T>
     static std::vector<T> loadArrayFromFile(const std::string& filename);
+
+    // Wczytuje tablicę z pliku bez wypisywania komunikatów (bezpieczne dla wielu wątków);
+    // zwraca false, jeśli pliku nie da się otworzyć lub odczytać
+    template <typename T>
+    static bool tryLoadArrayFromFile(const std::string& filename, std::vector<T>& arr);
+};
+
+// Klasa ShardCoordinator sortuje dane podzielone na wiele plików (shardów):
+// shardy są wczytywane i sortowane przez pulę wątków, a następnie
+// posortowane shardy są scalane (k-way merge) równolegle według zakresów kluczy
+class ShardCoordinator {
+public:
+    // Sortuje wszystkie pliki razem i zapisuje wynik w output;
+    // zwraca false, jeśli algorytm jest nieznany lub którykolwiek shard nie został wczytany
+    template <typename T>
+    static bool sortShards(const std::vector<std::string>& filenames,
+                           int algorithm, int option, int mergeThreads, std::vector<T>& output);
+
+private:
+    // Wybiera splittery na podstawie próbek z posortowanych shardów
+    template <typename T>
+    static std::vector<T> selectSplitters(const std::vector<std::vector<T>>& shards, int parts);
+
+    // Scala k posortowanych fragmentów [begin, end) do tablicy wynikowej od pozycji out
+    template <typename T>
+    static void kWayMerge(const std::vector<std::vector<T>>& shards,
+                          const std::vector<size_t>& begin, const std::vector<size_t>& end,
+                          std::vector<T>& output, size_t out);
+
+    // Wykonuje zadania 0..tasks-1 w co najwyżej maxThreads wątkach pobierających zadania z kolejki;
+    // jeśli nie uda się uruchomić kolejnego wątku, pozostałe zadania wykonują wątki już działające
+    static void runParallel(size_t tasks, size_t maxThreads, const std::function<void(size_t)>& task);
 };
 
 // Deklaracja szablonu klasy SortingApp do obsługi operacji na tablicach różnych typów
@@ -108,6 +153,7 @@ class SortingApp {
 private:
     std::vector<T> array;         // Tablica oryginalna
     std::vector<T> sortedArray;   // Tablica posortowana
+    bool sortedInSync = false;    // Czy sortedArray odpowiada aktualnej zawartości array
 
 public:
     // Uruchamia aplikację (wyświetla menu)
@@ -118,6 +164,7 @@ public:
     // Ustawia oryginalną tablicę
     void setArray(const std::vector<T>& arr) {
         array = arr;
+        sortedInSync = false;
     }
 
     // Zwraca oryginalną tablicę (jako stałą referencję, by unikać kopiowania)
@@ -128,6 +175,7 @@ public:
     // Ustawia posortowaną tablicę
     void setSortedArray(const std::vector<T>& arr) {
         sortedArray = arr;
+        sortedInSync = false;
     }
 
     // Zwraca posortowaną tablicę (jako stałą referencję)
@@ -138,51 +186,44 @@ public:
     // Wczytuje tablicę z pliku
     void readArrayFromFile(const std::string& filename) {
         array = FileManager::loadArrayFromFile<T>(filename);
+        sortedInSync = false;
     }
 
     // Generuje losową tablicę
     void generateRandomArray(int size) {
         array = DataGenerator::generateRandomArray<T>(size);
+        sortedInSync = false;
     }
 
     // Generuje posortowaną tablicę
     void generateSortedArray(int size, bool ascending) {
         array = DataGenerator::generateSortedArray<T>(size, ascending);
+        sortedInSync = false;
     }
 
     // Generuje częściowo posortowaną tablicę
     void generatePartiallySortedArray(int size, double percentSorted) {
         array = DataGenerator::generatePartiallySortedArray<T>(size, percentSorted);
+        sortedInSync = false;
     }
 
     // Sortuje tablicę przy użyciu wybranego algorytmu
     void sortArray(int algorithm, int option = 1) {
         // Tworzymy kopię oryginalnej tablicy, by zachować nieposortowane dane
         sortedArray = array;
+        sortedInSync = false;
 
         auto start = std::chrono::high_resolution_clock::now();
 
         // Wybór algorytmu sortowania
-        switch (algorithm) {
-            case 1: // Insertion Sort
-                Sorter::insertionSort(sortedArray);
-                break;
-            case 2: // Heap Sort
-                Sorter::heapSort(sortedArray);
-                break;
-            case 3: // Shell Sort
-                Sorter::shellSort(sortedArray, option);
-                break;
-            case 4: // Quick Sort
-                Sorter::quickSort(sortedArray, option);
-                break;
-            default:
-                std::cout << "Wrong algorithm!\n";
-                return;
+        if (!Sorter::sort(sortedArray, algorithm, option)) {
+            std::cout << "Wrong algorithm!\n";
+            return;
         }
 
         auto end = std::chrono::high_resolution_clock::now();
         std::chrono::duration<double, std::milli> elapsed = end - start;
+        sortedInSync = true;
 
         std::cout << "Sorting time: " << elapsed.count() << " ms\n";
 
@@ -193,6 +234,54 @@ public:
         std::cout << "Error: The array is not sorted.\n";
     }
 
+    // Tryb przyrostowy: sortuje nową porcję danych wybranym algorytmem
+    // i scala ją z już posortowaną tablicą (bez ponownego sortowania całości)
+    void insertBatch(const std::vector<T>& batch, int algorithm, int option = 1) {
+        if (!Sorter::isValidAlgorithm(algorithm)) {
+            std::cout << "Wrong algorithm!\n";
+            return;
+        }
+        syncSortedArray(algorithm, option);
+
+        std::vector<T> sortedBatch = batch;
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        Sorter::sort(sortedBatch, algorithm, option);
+        mergeSorted(sortedArray, sortedBatch);
+
+        auto end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::milli> elapsed = end - start;
+
+        // Tablica oryginalna zawiera wszystkie dotąd otrzymane dane
+        array.insert(array.end(), batch.begin(), batch.end());
+
+        std::cout << "Batch of " << batch.size() << " elements merged in "
+                  << elapsed.count() << " ms\n";
+
+        if (isSorted(sortedArray))
+        std::cout << "The array has been sorted correctly.\n";
+        else
+        std::cout << "Error: The array is not sorted.\n";
+    }
+
+    // Zwraca indeks pierwszego elementu nie mniejszego niż value (lower_bound),
+    // czyli liczbę elementów mniejszych od value
+    size_t lowerBound(const T& value) {
+        syncSortedArray(4, 3);
+        return std::lower_bound(sortedArray.begin(), sortedArray.end(), value) - sortedArray.begin();
+    }
+
+    // Zwraca liczbę elementów z przedziału [low, high]
+    size_t countInRange(const T& low, const T& high) {
+        syncSortedArray(4, 3);
+        if (high < low)
+            return 0;
+        auto first = std::lower_bound(sortedArray.begin(), sortedArray.end(), low);
+        auto last = std::upper_bound(first, sortedArray.end(), high);
+        return last - first;
+    }
+
     // Funkcja uruchamiająca testy wydajności
     void runPerformanceTest() {
         std::cout << "\n--- PERFORMANCE TEST ---\n";
@@ -300,6 +389,95 @@ public:
         resultFile.close();
         std::cout << "\nResults have been saved to 'performance_results.csv'\n";
     }
+
+    // Test wydajności trybu przyrostowego: scalanie porcji vs ponowne sortowanie całości
+    void runIncrementalTest() {
+        std::cout << "\n--- INCREMENTAL PERFORMANCE TEST ---\n";
+
+        // Rozmiary posortowanej tablicy bazowej oraz dokładanych porcji
+        std::vector<int> baseSizes = {10000, 50000, 100000, 200000};
+        std::vector<int> batchSizes = {100, 1000, 10000};
+
+        // Liczba powtórzeń dla uśrednienia
+        const int REPEATS = 20;
+
+        std::ofstream resultFile("incremental_results.csv");
+        if (!resultFile) {
+            std::cerr << "Cannot create result file!\n";
+            return;
+        }
+
+        // Nagłówki CSV
+        resultFile << "Base Size,Batch Size,Merge Time (ms),Full Re-sort Time (ms),"
+                      "Merge Rate (elem/ms),Re-sort Rate (elem/ms)\n";
+
+        for (int baseSize : baseSizes) {
+            for (int batchSize : batchSizes) {
+                std::cout << "  Base: " << baseSize << ", batch: " << batchSize << "... ";
+
+                std::vector<double> mergeTimes, resortTimes;
+
+                for (int rep = 0; rep < REPEATS; rep++) {
+                    std::vector<T> base = DataGenerator::generateSortedArray<T>(baseSize, true);
+                    std::vector<T> batch = DataGenerator::generateRandomArray<T>(batchSize);
+
+                    // Tryb przyrostowy: sortowanie porcji i scalanie z bazą
+                    std::vector<T> live = base;
+                    auto start = std::chrono::high_resolution_clock::now();
+                    std::vector<T> sortedBatch = batch;
+                    Sorter::quickSort(sortedBatch, 3); // Używamy środkowego pivota
+                    mergeSorted(live, sortedBatch);
+                    auto end = std::chrono::high_resolution_clock::now();
+                    mergeTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+
+                    // Ponowne sortowanie całości (setArray + sortArray)
+                    start = std::chrono::high_resolution_clock::now();
+                    std::vector<T> testArray = base;
+                    testArray.insert(testArray.end(), batch.begin(), batch.end());
+                    Sorter::quickSort(testArray, 3);
+                    end = std::chrono::high_resolution_clock::now();
+                    resortTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+                }
+
+                double avgMerge = std::accumulate(mergeTimes.begin(), mergeTimes.end(), 0.0) / mergeTimes.size();
+                double avgResort = std::accumulate(resortTimes.begin(), resortTimes.end(), 0.0) / resortTimes.size();
+                std::cout << "merge: " << avgMerge << " ms, re-sort: " << avgResort << " ms\n";
+
+                // Zapisanie wyniku do pliku (tempo przyjmowania danych w elementach na ms)
+                resultFile << baseSize << ","
+                           << batchSize << ","
+                           << avgMerge << ","
+                           << avgResort << ","
+                           << (avgMerge > 0 ? batchSize / avgMerge : 0.0) << ","
+                           << (avgResort > 0 ? batchSize / avgResort : 0.0) << "\n";
+            }
+        }
+
+        resultFile.close();
+        std::cout << "\nResults have been saved to 'incremental_results.csv'\n";
+    }
+
+private:
+    // Jeśli tablica została zmieniona od ostatniego sortowania, sortuje ją ponownie;
+    // sortedArray jest podmieniana dopiero po udanym sortowaniu
+    void syncSortedArray(int algorithm, int option) {
+        if (sortedInSync)
+            return;
+        std::cout << "Sorted array is out of date, sorting the current array first.\n";
+        std::vector<T> fresh = array;
+        if (!Sorter::sort(fresh, algorithm, option))
+            return;
+        sortedArray = std::move(fresh);
+        sortedInSync = true;
+    }
+
+    // Dołącza posortowaną porcję na koniec posortowanej tablicy dst i scala obie części
+    // (std::inplace_merge korzysta z bufora, jeśli jest dostępny, w przeciwnym razie scala w miejscu)
+    static void mergeSorted(std::vector<T>& dst, const std::vector<T>& batch) {
+        size_t middle = dst.size();
+        dst.insert(dst.end(), batch.begin(), batch.end());
+        std::inplace_merge(dst.begin(), dst.begin() + middle, dst.end());
+    }
 };
 
 // Implementacja funkcji sortowania w klasie Sorter
@@ -401,7 +579,8 @@ int Sorter::partition(std::vector<T>& arr, int low, int high, int pivotType) {
     else if (pivotType == 3)
         pivotIndex = low + (high - low) / 2; // Środkowy
     else { // Losowy
-        static std::mt19937 gen(std::random_device{}());
+        // Osobny generator dla każdego wątku (sortowanie shardów działa równolegle)
+        thread_local std::mt19937 gen(std::random_device{}());
         std::uniform_int_distribution<> dist(low, high);
         pivotIndex = dist(gen);
     }
@@ -435,6 +614,27 @@ void Sorter::quickSort(std::vector<T>& arr, int pivotType) {
     quickSortRecursive(arr, 0, arr.size() - 1, pivotType);
 }
 
+// Sortowanie wybranym algorytmem (wspólne dla SortingApp i ShardCoordinator)
+template <typename T>
+bool Sorter::sort(std::vector<T>& arr, int algorithm, int option) {
+    switch (algorithm) {
+        case 1: // Insertion Sort
+            insertionSort(arr);
+            return true;
+        case 2: // Heap Sort
+            heapSort(arr);
+            return true;
+        case 3: // Shell Sort
+            shellSort(arr, option);
+            return true;
+        case 4: // Quick Sort
+            quickSort(arr, option);
+            return true;
+        default:
+            return false;
+    }
+}
+
 // Implementacja funkcji generujących dane testowe w klasie DataGenerator
 
 // Generuje losową tablicę
@@ -503,20 +703,184 @@ bool FileManager::saveArrayToFile(const std::string& filename, const std::vector
 // Wczytuje tablicę z pliku
 template <typename T>
 std::vector<T> FileManager::loadArrayFromFile(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file) {
-        std::cerr << "Error: Cannot open file for reading.\n";
+    std::vector<T> arr;
+    if (!tryLoadArrayFromFile(filename, arr)) {
+        std::cerr << "Error: Cannot read array from file: " << filename << "\n";
         return {};
     }
+    std::cout << "Array loaded from file: " << filename << "\n";
+    return arr;
+}
+
+// Wczytuje tablicę z pliku bez komunikatów (wspólny czytnik dla całej aplikacji)
+template <typename T>
+bool FileManager::tryLoadArrayFromFile(const std::string& filename, std::vector<T>& arr) {
+    std::ifstream file(filename);
+    if (!file)
+        return false;
     int size;
-    file >> size;
-    std::vector<T> arr(size);
+    if (!(file >> size) || size < 0)
+        return false;
+    arr.resize(size);
     for (int i = 0; i < size; ++i) {
-        file >> arr[i];
+        if (!(file >> arr[i]))
+            return false;
+    }
+    return true;
+}
+
+// Implementacja sortowania shardów w klasie ShardCoordinator
+
+// Wczytuje i sortuje shardy równolegle, a następnie scala je według zakresów kluczy
+template <typename T>
+bool ShardCoordinator::sortShards(const std::vector<std::string>& filenames,
+                                  int algorithm, int option, int mergeThreads, std::vector<T>& output) {
+    if (!Sorter::isValidAlgorithm(algorithm)) {
+        std::cout << "Wrong algorithm!\n";
+        return false;
+    }
+    // Liczba wątków jest ograniczona liczbą rdzeni, niezależnie od liczby plików
+    size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    size_t k = filenames.size();
+    std::vector<std::vector<T>> shards(k);
+    // Status wczytania każdego shardu (char zamiast bool, by wątki nie dzieliły bajtów)
+    std::vector<char> loaded(k, 0);
+
+    // Wątki robocze pobierają kolejne pliki: wczytanie i sortowanie shardu
+    runParallel(k, maxThreads, [&](size_t i) {
+        loaded[i] = FileManager::tryLoadArrayFromFile<T>(filenames[i], shards[i]);
+        if (loaded[i])
+            Sorter::sort(shards[i], algorithm, option);
+    });
+
+    // Komunikaty o stanie shardów wypisujemy dopiero po zakończeniu wątków
+    bool allLoaded = true;
+    for (size_t i = 0; i < k; i++) {
+        if (loaded[i]) {
+            std::cout << "Shard " << i + 1 << " (" << filenames[i] << "): "
+                      << shards[i].size() << " elements loaded and sorted.\n";
+        } else {
+            std::cerr << "Error: Cannot load shard " << i + 1 << " (" << filenames[i] << ").\n";
+            allLoaded = false;
+        }
+    }
+    if (!allLoaded)
+        return false;
+
+    size_t total = 0;
+    for (const auto& shard : shards)
+        total += shard.size();
+    output.assign(total, T());
+
+    if (mergeThreads < 1)
+        mergeThreads = 1;
+    std::vector<T> splitters = selectSplitters(shards, mergeThreads);
+    int parts = splitters.size() + 1;
+
+    // Granice zakresów w każdym shardzie: bounds[p][i] to początek zakresu p w shardzie i
+    std::vector<std::vector<size_t>> bounds(parts + 1, std::vector<size_t>(k));
+    for (size_t i = 0; i < k; i++) {
+        bounds[0][i] = 0;
+        bounds[parts][i] = shards[i].size();
+        for (int p = 1; p < parts; p++) {
+            bounds[p][i] = std::lower_bound(shards[i].begin(), shards[i].end(), splitters[p - 1])
+                           - shards[i].begin();
+        }
+    }
+
+    // Pozycje początkowe zakresów w tablicy wynikowej
+    std::vector<size_t> offsets(parts + 1, 0);
+    for (int p = 0; p < parts; p++) {
+        offsets[p + 1] = offsets[p];
+        for (size_t i = 0; i < k; i++)
+            offsets[p + 1] += bounds[p + 1][i] - bounds[p][i];
+    }
+
+    // Każdy zakres kluczy jest scalany do rozłącznej części wyniku
+    runParallel(parts, maxThreads, [&](size_t p) {
+        kWayMerge(shards, bounds[p], bounds[p + 1], output, offsets[p]);
+    });
+
+    return true;
+}
+
+// Pula wątków z kolejką zadań opartą na liczniku atomowym
+void ShardCoordinator::runParallel(size_t tasks, size_t maxThreads,
+                                   const std::function<void(size_t)>& task) {
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t i = next++; i < tasks; i = next++)
+            task(i);
+    };
+
+    std::vector<std::thread> threads;
+    size_t count = std::min(tasks, maxThreads);
+    for (size_t t = 0; t < count; t++) {
+        try {
+            threads.emplace_back(worker);
+        } catch (const std::system_error&) {
+            // Nie udało się utworzyć wątku - zadania przejmą wątki już uruchomione
+            break;
+        }
+    }
+    // Bez żadnego wątku zadania wykonuje wątek wywołujący
+    if (threads.empty())
+        worker();
+    for (auto& thread : threads)
+        thread.join();
+}
+
+// Wybiera (parts - 1) splitterów z regularnie rozmieszczonych próbek każdego shardu
+template <typename T>
+std::vector<T> ShardCoordinator::selectSplitters(const std::vector<std::vector<T>>& shards, int parts) {
+    // Liczba próbek pobieranych z każdego shardu (nadpróbkowanie dla lepszego podziału)
+    const int SAMPLES_PER_PART = 16;
+    size_t samplesPerShard = static_cast<size_t>(parts) * SAMPLES_PER_PART;
+
+    std::vector<T> samples;
+    for (const auto& shard : shards) {
+        if (shard.empty())
+            continue;
+        size_t count = std::min(samplesPerShard, shard.size());
+        for (size_t j = 0; j < count; j++)
+            samples.push_back(shard[j * shard.size() / count]);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    std::vector<T> splitters;
+    if (samples.empty())
+        return splitters;
+    for (int p = 1; p < parts; p++) {
+        const T& candidate = samples[p * samples.size() / parts];
+        // Pomijamy powtarzające się splittery (puste zakresy)
+        if (splitters.empty() || splitters.back() < candidate)
+            splitters.push_back(candidate);
+    }
+    return splitters;
+}
+
+// K-way merge z użyciem kopca minimalnego (wartość, numer shardu)
+template <typename T>
+void ShardCoordinator::kWayMerge(const std::vector<std::vector<T>>& shards,
+                                 const std::vector<size_t>& begin, const std::vector<size_t>& end,
+                                 std::vector<T>& output, size_t out) {
+    using Entry = std::pair<T, size_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    std::vector<size_t> pos = begin;
+
+    for (size_t i = 0; i < shards.size(); i++) {
+        if (pos[i] < end[i])
+            heap.emplace(shards[i][pos[i]], i);
+    }
+    while (!heap.empty()) {
+        Entry top = heap.top();
+        heap.pop();
+        output[out++] = top.first;
+        size_t i = top.second;
+        if (++pos[i] < end[i])
+            heap.emplace(shards[i][pos[i]], i);
     }
-    file.close();
-    std::cout << "Array loaded from file: " << filename << "\n";
-    return arr;
 }
 
 // Implementacja interfejsu menu w klasie Menu
@@ -538,6 +902,10 @@ void Menu::display(SortingApp<T>& app) {
         std::cout << "7. Display sorted array\n";
         std::cout << "8. Save array to file\n";
         std::cout << "9. Run performance tests\n";
+        std::cout << "10. Insert batch into sorted array\n";
+        std::cout << "11. Query sorted array (lower bound / range count)\n";
+        std::cout << "12. Run incremental performance tests\n";
+        std::cout << "13. Sort shard files (shard-and-merge)\n";
         std::cout << "0. Exit\n";
         std::cout << "Choose an option: ";
         std::cin >> choice;
@@ -645,6 +1013,73 @@ void Menu::display(SortingApp<T>& app) {
             case 9:
                 app.runPerformanceTest();
             break;
+            case 10: {
+                int size, algoChoice;
+                std::cout << "Enter batch size: ";
+                std::cin >> size;
+                std::cout << "Choose algorithm for the batch (1 - Insertion, 2 - Heap, 3 - Shell, 4 - Quick): ";
+                std::cin >> algoChoice;
+                // Dla Shell Sort używamy sekwencji Knutha, dla Quick Sort środkowego pivota
+                int option = (algoChoice == 4) ? 3 : 1;
+                app.insertBatch(DataGenerator::generateRandomArray<T>(size), algoChoice, option);
+                break;
+            }
+            case 11: {
+                T low, high;
+                std::cout << "Enter lower bound: ";
+                std::cin >> low;
+                std::cout << "Enter upper bound: ";
+                std::cin >> high;
+                size_t lower = app.lowerBound(low);
+                size_t inRange = app.countInRange(low, high);
+                std::cout << "Elements smaller than " << low << " (lower bound): " << lower << "\n";
+                std::cout << "Elements in [" << low << ", " << high << "]: " << inRange << "\n";
+                break;
+            }
+            case 12:
+                app.runIncrementalTest();
+            break;
+            case 13: {
+                int count, algoChoice;
+                std::cout << "Enter number of shard files: ";
+                std::cin >> count;
+                std::vector<std::string> shardFiles(count);
+                for (int i = 0; i < count; i++) {
+                    std::cout << "Enter file name " << i + 1 << ": ";
+                    std::cin >> shardFiles[i];
+                }
+                std::cout << "Choose algorithm for the shards (1 - Insertion, 2 - Heap, 3 - Shell, 4 - Quick): ";
+                std::cin >> algoChoice;
+                if (!Sorter::isValidAlgorithm(algoChoice)) {
+                    std::cout << "Wrong algorithm!\n";
+                    break;
+                }
+                std::cout << "Enter output file name: ";
+                std::cin >> filename;
+                // Dla Shell Sort używamy sekwencji Knutha, dla Quick Sort środkowego pivota
+                int option = (algoChoice == 4) ? 3 : 1;
+                int mergeThreads = std::max(1u, std::thread::hardware_concurrency());
+
+                auto start = std::chrono::high_resolution_clock::now();
+                std::vector<T> merged;
+                bool ok = ShardCoordinator::sortShards<T>(shardFiles, algoChoice, option, mergeThreads, merged);
+                auto end = std::chrono::high_resolution_clock::now();
+                std::chrono::duration<double, std::milli> elapsed = end - start;
+
+                if (!ok) {
+                    std::cout << "Error: Shard sorting failed, output file was not written.\n";
+                    break;
+                }
+
+                std::cout << "Sorted " << merged.size() << " elements from " << count
+                          << " shards in " << elapsed.count() << " ms\n";
+                if (isSorted(merged))
+                    std::cout << "The array has been sorted correctly.\n";
+                else
+                    std::cout << "Error: The array is not sorted.\n";
+                FileManager::saveArrayToFile<T>(filename, merged);
+                break;
+            }
             case 0:
                 std::cout << "Goodbye!\n";
             break;